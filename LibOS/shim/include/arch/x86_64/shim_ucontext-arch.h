@@ -7,6 +7,11 @@
 #include <ucontext.h>
 
 static inline void shim_regs_to_ucontext(ucontext_t* context, struct shim_regs* regs) {
+    /* `struct shim_regs` is laid out by the push sequence in syscalldb (see
+     * "syscallas-x86_64.S" and restore_context()), which is the reverse of the gregset order,
+     * so the GPR block cannot be copied with wide moves without rewriting the entry/exit
+     * assembly; keep the scalar stores for the shuffled fields and let the memset below take
+     * care of the zeroed tail in two wide stores. */
     context->uc_mcontext.gregs[REG_R8]  = regs->r8;
     context->uc_mcontext.gregs[REG_R9]  = regs->r9;
     context->uc_mcontext.gregs[REG_R10] = regs->r10;
@@ -25,11 +30,8 @@ static inline void shim_regs_to_ucontext(ucontext_t* context, struct shim_regs*
     context->uc_mcontext.gregs[REG_RSP] = regs->rsp;
     context->uc_mcontext.gregs[REG_RIP] = regs->rip;
     context->uc_mcontext.gregs[REG_EFL] = regs->rflags;
-    context->uc_mcontext.gregs[REG_CSGSFS] = 0;
-    context->uc_mcontext.gregs[REG_ERR] = 0;
-    context->uc_mcontext.gregs[REG_TRAPNO] = 0;
-    context->uc_mcontext.gregs[REG_OLDMASK] = 0;
-    context->uc_mcontext.gregs[REG_CR2]  = 0;
+    memset(&context->uc_mcontext.gregs[REG_CSGSFS], 0,
+           (REG_CR2 - REG_CSGSFS + 1) * sizeof(greg_t));
 }
 
 #endif /* _SHIM_UCONTEXT_ARCH_H_ */
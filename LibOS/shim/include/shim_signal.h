@@ -89,6 +89,15 @@ __SIGSETFN (shim_sigdelset, ((__set->__val[__word] &= ~__mask), 0), )
 #define __sigaddset   shim_sigaddset
 #define __sigdelset   shim_sigdelset
 
+/* NUM_SIGS <= 64, so the whole signal set fits into the first (and only) word of __sigset_t;
+ * bit `sig - 1` corresponds to signal `sig`. This lets hot paths test a full set with one AND
+ * against a pending-signal bitmap instead of NUM_SIGS __sigismember calls. */
+static inline uint64_t __sigset_word(const __sigset_t* set) {
+    static_assert(sizeof(set->__val) == sizeof(uint64_t),
+                  "__sigset_word assumes a single-word sigset");
+    return set->__val[0];
+}
+
 /* NB: Check shim_signal.c if this changes.  Some memset(0) elision*/
 struct shim_signal {
     siginfo_t   info;
@@ -99,6 +108,10 @@ struct shim_signal {
 
 void get_pending_signals(struct shim_thread* thread, __sigset_t* set);
 
+void prime_signal_cache(struct shim_thread* thread);
+void clear_signal_queue(struct shim_thread* thread);
+void clear_signal_cache(struct shim_thread* thread);
+
 struct shim_thread;
 
 int init_signal (void);
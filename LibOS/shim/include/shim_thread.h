@@ -29,17 +29,57 @@ struct wake_queue_head {
 
 struct shim_signal_handles {
     struct __kernel_sigaction actions[NUM_SIGS];
+    /* Sequence counter protecting `actions` for lock-free readers (odd value = write in
+     * progress). Writers additionally hold `lock` to serialize against each other; see
+     * `get_sighandler` in "LibOS/shim/src/bookkeep/shim_signal.c". */
+    uint32_t seq;
     struct shim_lock lock;
     REFTYPE ref_count;
 };
 
+/* Bracket every update of `handles->actions` with these helpers (with `handles->lock` held), so
+ * that lock-free readers can detect a torn read and retry. */
+static inline void signal_handles_write_begin(struct shim_signal_handles* handles) {
+    __atomic_store_n(&handles->seq, handles->seq + 1, __ATOMIC_RELAXED);
+    /* order the counter bump before the action updates (smp_wmb) */
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+}
+
+static inline void signal_handles_write_end(struct shim_signal_handles* handles) {
+    /* order the action updates before the counter bump (smp_wmb) */
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    __atomic_store_n(&handles->seq, handles->seq + 1, __ATOMIC_RELAXED);
+}
+
 /* For more info see: man signal(7) */
 #define MAX_SIGNAL_LOG 32
 
+/* One ring slot. `seq` encodes `(lap << 1) | full`, where `lap` is `idx / MAX_SIGNAL_LOG` of
+ * the ring index the slot is (to be) used for and `full` is set while the slot holds a
+ * published signal. A producer may only fill a slot whose `seq` says "free for my lap" and a
+ * consumer may only drain one that says "full for my lap", so a lagging peer that reserved a
+ * ring index but has not finished its slot access yet makes the other side report full/empty
+ * instead of corrupting the slot or spinning on it (see append_rt_signal/pop_rt_signal in
+ * "LibOS/shim/src/bookkeep/shim_signal.c"). A zero-initialized queue reads "all slots free for
+ * lap 0", which is the correct initial state. */
+struct shim_rt_signal_slot {
+    uint64_t seq;
+    struct shim_signal* signal;
+};
+
 struct shim_rt_signal_queue {
+    /* Producer and consumer hammer the two cursors with atomic RMWs from different cores, while
+     * each `queue[]` slot is written once per signal; give the cursors a cache line of their own
+     * so cursor traffic does not false-share with the payload slots (or with the neighbouring
+     * queue in `rt_signal_queues[]`). */
     uint64_t put_idx;
     uint64_t get_idx;
-    struct shim_signal* queue[MAX_SIGNAL_LOG];
+    /* No aligned(64) on the struct: `shim_thread` objects come from the slab allocator (and, on
+     * restore, the checkpoint buffer), which only guarantee 16-byte alignment, and requesting
+     * more than the allocation delivers would be undefined behavior. The padding alone keeps
+     * the cursor pair and the payload slots from sharing a cache line. */
+    char _pad[64 - 2 * sizeof(uint64_t)];
+    struct shim_rt_signal_slot queue[MAX_SIGNAL_LOG];
 };
 
 struct shim_signal_queue {
@@ -84,9 +124,16 @@ struct shim_thread {
     __sigset_t signal_mask;
     struct shim_signal_handles* signal_handles;
     struct shim_signal_queue signal_queue;
-    /* For the field below, see the explanation in "LibOS/shim/src/bookkeep/shim_signal.c" near
-     * `process_pending_signals_cnt`. */
+    /* Cache of free `shim_signal` objects, so that the delivery path does not have to call
+     * the heap allocator on each signal. Only ever touched by the owning thread; see
+     * the comment at `signal_cache_alloc` in "LibOS/shim/src/bookkeep/shim_signal.c". */
+    struct shim_signal* signal_cache;
+    size_t signal_cache_len;
+    /* For the two fields below, see the explanation in "LibOS/shim/src/bookkeep/shim_signal.c"
+     * near `process_pending_signals_cnt`. `pending_signal_map` has bit `sig - 1` set while
+     * signal `sig` might be queued; it is a hint with the same caveats as the counter. */
     uint64_t pending_signals;
+    uint64_t pending_signal_map;
     bool signal_handled;
     stack_t signal_altstack;
 
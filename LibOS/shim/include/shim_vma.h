@@ -107,6 +107,11 @@ int lookup_vma(void* addr, struct shim_vma_info* vma_info);
 /* Returns true if the whole range [`addr`, `addr` + `length`) is mapped as user memory. */
 bool is_in_adjacent_user_vmas(void* addr, size_t length);
 
+/* Looks for the terminating NUL of the user string at `addr` while walking adjacent user VMAs,
+ * taking the VMA tree lock only once. Returns true and puts the string length into `*size_ptr`
+ * if the whole string (including the NUL) is mapped as user memory, false otherwise. */
+bool strlen_in_adjacent_user_vmas(const char* addr, size_t* size_ptr);
+
 /*
  * Dumps all non-internal and mapped VMAs.
  * On success returns 0 and puts the pointer to result array into `*vma_infos` and its length into
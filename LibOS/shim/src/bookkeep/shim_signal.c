@@ -40,6 +40,7 @@ void sigaction_make_defaults(struct __kernel_sigaction* sig_action) {
 
 void thread_sigaction_reset_on_execve(struct shim_thread* thread) {
     lock(&thread->signal_handles->lock);
+    signal_handles_write_begin(thread->signal_handles);
     for (size_t i = 0; i < ARRAY_SIZE(thread->signal_handles->actions); i++) {
         struct __kernel_sigaction* sig_action = &thread->signal_handles->actions[i];
 
@@ -53,10 +54,11 @@ void thread_sigaction_reset_on_execve(struct shim_thread* thread) {
         /* app installed its own signal handler, reset it to default */
         sigaction_make_defaults(sig_action);
     }
+    signal_handles_write_end(thread->signal_handles);
     unlock(&thread->signal_handles->lock);
 }
 
-static __rt_sighandler_t default_sighandler[NUM_SIGS];
+static __rt_sighandler_t default_sighandler(int sig);
 
 static struct shim_signal_queue process_signal_queue = { 0 };
 /* This is just an optimization, not to have to check the queue for pending signals. A thread will
@@ -64,6 +66,13 @@ static struct shim_signal_queue process_signal_queue = { 0 };
  * no matter what is the relative ordering of increasing this variable vs. appending signal to
  * the queue. */
 static uint64_t process_pending_signals_cnt = 0;
+/* Bit `sig - 1` is set while signal `sig` might be pending in `process_signal_queue`; a hint
+ * with the same caveats as the counter above (and as `thread->pending_signal_map`). It lets
+ * `__handle_signals` visit only signals that are actually pending instead of scanning all of
+ * the NUM_SIGS queues on every delivery. */
+static uint64_t process_pending_signal_map = 0;
+
+static_assert(NUM_SIGS <= 64, "pending signal maps assume at most 64 signals");
 
 /*
  * These checks are racy, but we can't do better anyway: signal can be delivered in any moment.
@@ -84,24 +93,22 @@ static bool has_standard_signal(struct shim_signal** queue) {
     return !!__atomic_load_n(queue, __ATOMIC_ACQUIRE);
 }
 
+static bool queue_has_signal(struct shim_signal_queue* queue, int sig);
+
 void get_pending_signals(struct shim_thread* thread, __sigset_t* set) {
     __sigemptyset(set);
 
-    if (__atomic_load_n(&thread->pending_signals, __ATOMIC_ACQUIRE) == 0
-            && __atomic_load_n(&process_pending_signals_cnt, __ATOMIC_ACQUIRE) == 0) {
-        return;
-    }
+    /* The map bits are hints that can be stale, so confirm each flagged signal against its
+     * queues; but only the flagged ones are visited, instead of all NUM_SIGS of them. */
+    uint64_t pending = __atomic_load_n(&thread->pending_signal_map, __ATOMIC_ACQUIRE)
+                       | __atomic_load_n(&process_pending_signal_map, __ATOMIC_ACQUIRE);
 
-    for (int sig = 1; sig < SIGRTMIN; sig++) {
-        if (has_standard_signal(&thread->signal_queue.standard_signals[sig - 1])
-                || has_standard_signal(&process_signal_queue.standard_signals[sig - 1])) {
-            __sigaddset(set, sig);
-        }
-    }
+    while (pending) {
+        int sig = __builtin_ctzll(pending) + 1;
+        pending &= pending - 1;
 
-    for (int sig = SIGRTMIN; sig <= NUM_SIGS; sig++) {
-        if (!is_rt_sq_empty(&thread->signal_queue.rt_signal_queues[sig - SIGRTMIN])
-                || !is_rt_sq_empty(&process_signal_queue.rt_signal_queues[sig - SIGRTMIN])) {
+        if (queue_has_signal(&thread->signal_queue, sig)
+                || queue_has_signal(&process_signal_queue, sig)) {
             __sigaddset(set, sig);
         }
     }
@@ -113,28 +120,48 @@ static bool append_standard_signal(struct shim_signal** signal_slot, struct shim
                                        __ATOMIC_RELEASE, __ATOMIC_ACQUIRE);
 }
 
+/* Sequence word a slot holds while free for ring index `idx`; setting the low bit marks it
+ * full for the same lap (see the comment at `struct shim_rt_signal_slot`). */
+static inline uint64_t rt_sq_free_seq(uint64_t idx) {
+    return (idx / MAX_SIGNAL_LOG) << 1;
+}
+
+#define RT_SQ_FULL_BIT 1ul
+
 /* In theory `get_idx` and `put_idx` could overflow, but adding signals with 1GHz (10**9 signals
  * per second) gives a 544 years running time before overflow, which we consider a "safe margin"
  * for now. */
 static bool append_rt_signal(struct shim_rt_signal_queue* queue,
                                     struct shim_signal* signal) {
-    uint64_t get_idx;
-    uint64_t put_idx = __atomic_load_n(&queue->put_idx, __ATOMIC_ACQUIRE);
-    do {
-        get_idx = __atomic_load_n(&queue->get_idx, __ATOMIC_ACQUIRE);
-        assert(put_idx >= get_idx);
-
-        /* This is a bit racy i.e. it might report full queue, when it's just being emptied, but
-         * it's the best we can do. Note that `get_idx` can only be increased, but never past
-         * `put_idx`. */
-        if (put_idx - get_idx >= ARRAY_SIZE(queue->queue)) {
+    uint64_t put_idx = __atomic_load_n(&queue->put_idx, __ATOMIC_RELAXED);
+
+    while (1) {
+        struct shim_rt_signal_slot* slot = &queue->queue[put_idx % ARRAY_SIZE(queue->queue)];
+        uint64_t free_seq = rt_sq_free_seq(put_idx);
+        uint64_t seq = __atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE);
+
+        if (seq == free_seq) {
+            if (__atomic_compare_exchange_n(&queue->put_idx, &put_idx, put_idx + 1, /*weak=*/true,
+                                            __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                /* The CAS only reserved the index; the release store of `seq` is what publishes
+                 * the signal to the consumer. The cursors carry no payload ordering, hence the
+                 * relaxed operations on them. */
+                slot->signal = signal;
+                __atomic_store_n(&slot->seq, free_seq | RT_SQ_FULL_BIT, __ATOMIC_RELEASE);
+                return true;
+            }
+            /* Lost the cursor race; the CAS reloaded `put_idx`, retry with it. */
+        } else if ((int64_t)(seq - free_seq) < 0) {
+            /* The slot was not released since the previous lap: either the ring is genuinely
+             * full, or it wrapped onto a slot whose (preempted) consumer reserved an index but
+             * has not drained it yet. Report full rather than wait - waiting could deadlock if
+             * that consumer sits below us on this very stack. */
             return false;
+        } else {
+            /* A faster producer already filled the slot for this lap; reload the cursor. */
+            put_idx = __atomic_load_n(&queue->put_idx, __ATOMIC_RELAXED);
         }
-    } while (!__atomic_compare_exchange_n(&queue->put_idx, &put_idx, put_idx + 1, /*weak=*/true,
-                                          __ATOMIC_RELEASE, __ATOMIC_ACQUIRE));
-
-    queue->queue[put_idx % ARRAY_SIZE(queue->queue)] = signal;
-    return true;
+    }
 }
 
 static bool queue_append_signal(struct shim_signal_queue* queue, struct shim_signal* signal) {
@@ -152,6 +179,8 @@ static bool queue_append_signal(struct shim_signal_queue* queue, struct shim_sig
 static bool append_thread_signal(struct shim_thread* thread, struct shim_signal* signal) {
     bool ret = queue_append_signal(&thread->signal_queue, signal);
     if (ret) {
+        __atomic_fetch_or(&thread->pending_signal_map, 1ULL << (signal->info.si_signo - 1),
+                          __ATOMIC_RELEASE);
         (void)__atomic_add_fetch(&thread->pending_signals, 1, __ATOMIC_RELEASE);
     }
     return ret;
@@ -160,29 +189,63 @@ static bool append_thread_signal(struct shim_thread* thread, struct shim_signal*
 static bool append_process_signal(struct shim_signal* signal) {
     bool ret = queue_append_signal(&process_signal_queue, signal);
     if (ret) {
+        __atomic_fetch_or(&process_pending_signal_map, 1ULL << (signal->info.si_signo - 1),
+                          __ATOMIC_RELEASE);
         (void)__atomic_add_fetch(&process_pending_signals_cnt, 1, __ATOMIC_RELEASE);
     }
     return ret;
 }
 
+static bool queue_has_signal(struct shim_signal_queue* queue, int sig) {
+    if (sig < SIGRTMIN) {
+        return has_standard_signal(&queue->standard_signals[sig - 1]);
+    }
+    return !is_rt_sq_empty(&queue->rt_signal_queues[sig - SIGRTMIN]);
+}
+
+/* Retire a stale pending-map hint bit for `sig`, re-checking the queue afterwards so that
+ * a signal appended concurrently with the clear is not lost. */
+static void clear_pending_signal_bit(uint64_t* map, struct shim_signal_queue* queue, int sig) {
+    uint64_t bit = 1ULL << (sig - 1);
+    __atomic_fetch_and(map, ~bit, __ATOMIC_ACQ_REL);
+    if (queue_has_signal(queue, sig)) {
+        __atomic_fetch_or(map, bit, __ATOMIC_RELEASE);
+    }
+}
+
 static struct shim_signal* pop_standard_signal(struct shim_signal** signal_slot) {
     return __atomic_exchange_n(signal_slot, NULL, __ATOMIC_ACQ_REL);
 }
 
 static struct shim_signal* pop_rt_signal(struct shim_rt_signal_queue* queue) {
-    uint64_t put_idx;
-    uint64_t get_idx = __atomic_load_n(&queue->get_idx, __ATOMIC_ACQUIRE);
-    do {
-        put_idx = __atomic_load_n(&queue->put_idx, __ATOMIC_ACQUIRE);
-        assert(put_idx >= get_idx);
-
-        if (put_idx == get_idx) {
+    uint64_t get_idx = __atomic_load_n(&queue->get_idx, __ATOMIC_RELAXED);
+
+    while (1) {
+        struct shim_rt_signal_slot* slot = &queue->queue[get_idx % ARRAY_SIZE(queue->queue)];
+        uint64_t full_seq = rt_sq_free_seq(get_idx) | RT_SQ_FULL_BIT;
+        uint64_t seq = __atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE);
+
+        if (seq == full_seq) {
+            if (__atomic_compare_exchange_n(&queue->get_idx, &get_idx, get_idx + 1, /*weak=*/true,
+                                            __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                struct shim_signal* signal = slot->signal;
+                /* Hand the slot to the producers of the next lap. */
+                __atomic_store_n(&slot->seq, rt_sq_free_seq(get_idx + ARRAY_SIZE(queue->queue)),
+                                 __ATOMIC_RELEASE);
+                return signal;
+            }
+            /* Lost the cursor race; the CAS reloaded `get_idx`, retry with it. */
+        } else if ((int64_t)(seq - full_seq) < 0) {
+            /* Nothing published at the cursor: the queue is empty, or a producer reserved the
+             * index but has not finished its release store yet. Report empty rather than wait -
+             * the pending-map hint machinery re-checks the queue and the signal is picked up on
+             * a later scan. */
             return NULL;
+        } else {
+            /* Another consumer already drained the slot for this lap; reload the cursor. */
+            get_idx = __atomic_load_n(&queue->get_idx, __ATOMIC_RELAXED);
         }
-    } while (!__atomic_compare_exchange_n(&queue->get_idx, &get_idx, get_idx + 1, /*weak=*/true,
-                                          __ATOMIC_RELEASE, __ATOMIC_ACQUIRE));
-
-    return queue->queue[get_idx % ARRAY_SIZE(queue->queue)];
+    }
 }
 
 static struct shim_signal* queue_pop_signal(struct shim_signal_queue* queue, int sig) {
@@ -211,7 +274,91 @@ static struct shim_signal* process_pop_signal(int sig) {
     return signal;
 }
 
-static void __handle_one_signal(shim_tcb_t* tcb, struct shim_signal* signal);
+/*
+ * Per-thread cache of free `shim_signal` objects.
+ *
+ * Under signal storms the malloc/free pair per delivered signal dominates the delivery path, so
+ * recycle a bounded number of objects instead. A free object stores the link to the next one in
+ * its first machine word (the object is dead, so its contents do not matter).
+ *
+ * The cache is only touched by the owning thread and only while the preemption counter is exactly
+ * one (i.e. the caller itself just disabled preemption): an asynchronous `deliver_signal` that
+ * interrupts a cache operation observes a preemption counter greater than one and takes the plain
+ * malloc path, so the cache needs no locking.
+ */
+#define SIGNAL_CACHE_SIZE 16
+
+static struct shim_signal* signal_cache_alloc(struct shim_thread* thread) {
+    struct shim_signal* signal = thread->signal_cache;
+    if (signal) {
+        thread->signal_cache = *(struct shim_signal**)signal;
+        thread->signal_cache_len--;
+        return signal;
+    }
+    return malloc(sizeof(struct shim_signal));
+}
+
+static void signal_cache_free(struct shim_thread* thread, struct shim_signal* signal) {
+    if (thread && thread->signal_cache_len < SIGNAL_CACHE_SIZE) {
+        *(struct shim_signal**)signal = thread->signal_cache;
+        thread->signal_cache = signal;
+        thread->signal_cache_len++;
+        return;
+    }
+    free(signal);
+}
+
+/* Pre-fill the cache at thread creation, so the first signal burst a thread receives is served
+ * from the cache instead of hitting malloc from the delivery path. Best effort: a failed
+ * allocation just leaves the cache shorter, and `signal_cache_alloc` falls back to malloc. */
+void prime_signal_cache(struct shim_thread* thread) {
+    while (thread->signal_cache_len < SIGNAL_CACHE_SIZE) {
+        struct shim_signal* signal = malloc(sizeof(*signal));
+        if (!signal) {
+            return;
+        }
+        *(struct shim_signal**)signal = thread->signal_cache;
+        thread->signal_cache = signal;
+        thread->signal_cache_len++;
+    }
+}
+
+/* Drain and free everything still queued for `thread` in one pass over the pending map.
+ * Called on thread destruction, when no one can append to or pop from the queues anymore
+ * (previously these signals were simply leaked together with whatever append_signal
+ * allocated for them). */
+void clear_signal_queue(struct shim_thread* thread) {
+    uint64_t pending = thread->pending_signal_map;
+
+    while (pending) {
+        int sig = __builtin_ctzll(pending) + 1;
+        pending &= pending - 1;
+
+        struct shim_signal* signal;
+        while ((signal = queue_pop_signal(&thread->signal_queue, sig))) {
+            free(signal);
+        }
+    }
+
+    thread->pending_signals = 0;
+    thread->pending_signal_map = 0;
+}
+
+/* Called on thread destruction; no concurrent users of the cache exist at this point. */
+void clear_signal_cache(struct shim_thread* thread) {
+    struct shim_signal* signal = thread->signal_cache;
+    while (signal) {
+        struct shim_signal* next = *(struct shim_signal**)signal;
+        free(signal);
+        signal = next;
+    }
+    thread->signal_cache = NULL;
+    thread->signal_cache_len = 0;
+}
+
+static void __handle_one_signal(shim_tcb_t* tcb, struct shim_signal* signal,
+                                __rt_sighandler_t handler);
+static __rt_sighandler_t get_sighandler(struct shim_thread* thread, int sig, bool allow_reset);
 
 static void __store_info (siginfo_t * info, struct shim_signal * signal)
 {
@@ -255,27 +402,59 @@ void deliver_signal (siginfo_t * info, PAL_CONTEXT * context)
 
     int64_t preempt = __disable_preempt(tcb);
 
-    struct shim_signal * signal = __alloca(sizeof(struct shim_signal));
-    /* save in signal */
-    memset(signal, 0, sizeof(struct shim_signal));
+    /* Decide up front whether the signal has to be queued, so that a queued signal is built
+     * directly in its final (heap) location instead of being prepared on the stack and then
+     * copied wholesale - `struct shim_signal` is over a kilobyte. */
+    bool defer = preempt > 1 || (__sigset_word(&cur_thread->signal_mask) & __sigmask(sig));
+
+    __rt_sighandler_t handler = NULL;
+    struct shim_signal* signal;
+    if (defer) {
+        /* The cache may only be used if we did not interrupt another cache operation, i.e. if
+         * the preemption counter was zero before we increased it. */
+        signal = preempt > 1 ? malloc(sizeof(struct shim_signal))
+                             : signal_cache_alloc(cur_thread);
+        if (!signal) {
+            goto out;
+        }
+    } else {
+        /* Resolve the handler before building the signal: if the signal is ignored, delivery
+         * amounts to draining the pending queues and none of the context capture below has an
+         * observer, so skip it entirely. */
+        handler = get_sighandler(cur_thread, sig, /*allow_reset=*/true);
+        if (!handler) {
+            __handle_signals(tcb);
+            goto out;
+        }
+        signal = __alloca(sizeof(struct shim_signal));
+    }
+
+    /* Save in signal. Only `context` needs explicit zeroing (its tail - fp state, sigmask,
+     * stack - is not filled by __store_context and ends up visible to the app handler); `info`
+     * is overwritten wholesale by __store_info and the remaining fields are assigned below, so
+     * zeroing the whole kilobyte-sized struct would be wasted bandwidth on every delivery. */
+    memset(&signal->context, 0, sizeof(signal->context));
+    signal->context_stored = false;
     __store_info(info, signal);
     __store_context(tcb, context, signal);
     signal->pal_context = context;
 
-    if (preempt > 1 || __sigismember(&cur_thread->signal_mask, sig)) {
-        signal = malloc_copy(signal,sizeof(struct shim_signal));
-        if (signal) {
-            if (!append_thread_signal(cur_thread, signal)) {
-                debug("Signal %d queue of thread %u is full, dropping the incoming signal\n",
-                      sig, tcb->tid);
+    if (defer) {
+        if (__builtin_expect(!append_thread_signal(cur_thread, signal), 0)) {
+            debug("Signal %d queue of thread %u is full, dropping the incoming signal\n",
+                  sig, tcb->tid);
+            if (preempt > 1) {
                 free(signal);
+            } else {
+                signal_cache_free(cur_thread, signal);
             }
         }
     } else {
-        __handle_one_signal(tcb, signal);
+        __handle_one_signal(tcb, signal, handler);
         __handle_signals(tcb);
     }
 
+out:
     __enable_preempt(tcb);
 }
 
@@ -289,18 +468,25 @@ void deliver_signal (siginfo_t * info, PAL_CONTEXT * context)
         _info;                                              \
     })
 
+/* LibOS text bounds, snapshotted in `init_signal` so the fault predicates below become a
+ * single sub + unsigned compare instead of two loads of linker symbols per call. */
+static struct {
+    uintptr_t start;
+    uintptr_t len;
+} g_libos_text_range;
+
 static inline bool context_is_internal(PAL_CONTEXT * context)
 {
     if (!context)
         return false;
 
-    void* ip = (void*)pal_context_get_ip(context);
+    uintptr_t ip = (uintptr_t)pal_context_get_ip(context);
 
-    return ip >= (void*)&__code_address &&
-           ip  < (void*)&__code_address_end;
+    return ip - g_libos_text_range.start < g_libos_text_range.len;
 }
 
-static noreturn void internal_fault(const char* errstr, PAL_NUM addr, PAL_CONTEXT* context) {
+static noreturn __attribute__((cold)) void internal_fault(const char* errstr, PAL_NUM addr,
+                                                          PAL_CONTEXT* context) {
     IDTYPE tid = get_cur_tid();
     PAL_NUM ip = pal_context_get_ip(context);
 
@@ -345,50 +531,53 @@ static void memfault_upcall (PAL_PTR event, PAL_NUM arg, PAL_CONTEXT * context)
         goto ret_exception;
     }
 
-    if (is_internal_tid(get_cur_tid()) || context_is_internal(context)) {
+    if (is_internal_tid(tcb->tid) || context_is_internal(context)) {
         internal_fault("Internal memory fault", arg, context);
     }
 
     if (context)
         debug("memory fault at 0x%08lx (IP = 0x%08lx)\n", arg, pal_context_get_ip(context));
 
-    struct shim_vma_info vma_info;
-    int signo = SIGSEGV;
-    int code;
-    if (!arg) {
-        code = SEGV_MAPERR;
-    } else if (!lookup_vma((void *) arg, &vma_info)) {
-        if (vma_info.flags & VMA_INTERNAL) {
-            internal_fault("Internal memory fault with VMA", arg, context);
-        }
-        struct shim_handle* file = vma_info.file;
-        if (file && file->type == TYPE_FILE) {
-            /* DEP 3/3/17: If the mapping exceeds end of a file (but is in the VMA)
-             * then return a SIGBUS. */
-            uintptr_t eof_in_vma = (uintptr_t)vma_info.addr + vma_info.file_offset
-                                    + file->info.file.size;
-            if (arg > eof_in_vma) {
-                signo = SIGBUS;
-                code = BUS_ADRERR;
-            } else if (pal_context_has_user_pagefault(context) && !(vma_info.flags & PROT_WRITE)) {
-                /* DEP 3/3/17: If the page fault gives a write error, and
-                 * the VMA is read-only, return SIGSEGV+SEGV_ACCERR */
-                signo = SIGSEGV;
-                code = SEGV_ACCERR;
-            } else {
-                /* XXX: need more sophisticated judgement */
-                signo = SIGBUS;
-                code = BUS_ADRERR;
-            }
-        } else {
-            code = SEGV_ACCERR;
-        }
+    /* Classify the fault via a 16-entry table indexed by the four predicates below instead of a
+     * ladder of data-dependent branches (fault storms make those mispredict badly). The policy
+     * is unchanged (DEP 3/3/17): faults past end-of-file in a file mapping are SIGBUS, writes to
+     * a read-only file mapping are SIGSEGV+SEGV_ACCERR, other file faults are SIGBUS (XXX: need
+     * more sophisticated judgement), and everything else is plain SIGSEGV. */
+#define FAULT_SC(signo, code) ((uint32_t)(signo) | ((uint32_t)(code) << 16))
+    static const uint32_t fault_table[16] = {
+        [0 ... 7]   = FAULT_SC(SIGSEGV, SEGV_MAPERR), /* no VMA covers the address */
+        [8 ... 11]  = FAULT_SC(SIGSEGV, SEGV_ACCERR), /* non-file VMA */
+        [12]        = FAULT_SC(SIGBUS,  BUS_ADRERR),  /* file VMA, in-file read fault */
+        [13]        = FAULT_SC(SIGSEGV, SEGV_ACCERR), /* write to read-only file VMA */
+        [14 ... 15] = FAULT_SC(SIGBUS,  BUS_ADRERR),  /* file VMA, fault past end of file */
+    };
+#undef FAULT_SC
 
-        if (file) {
-            put_handle(file);
-        }
-    } else {
-        code = SEGV_MAPERR;
+    struct shim_vma_info vma_info = { .file = NULL };
+    bool has_vma = arg && !lookup_vma((void *) arg, &vma_info);
+
+    if (has_vma && (vma_info.flags & VMA_INTERNAL)) {
+        internal_fault("Internal memory fault with VMA", arg, context);
+    }
+
+    struct shim_handle* file = vma_info.file;
+    bool is_file    = has_vma && file && file->type == TYPE_FILE;
+    bool above_eof  = false;
+    bool write_ro   = false;
+    if (is_file) {
+        uintptr_t eof_in_vma = (uintptr_t)vma_info.addr + vma_info.file_offset
+                                + file->info.file.size;
+        above_eof = arg > eof_in_vma;
+        write_ro  = pal_context_has_user_pagefault(context) && !(vma_info.flags & PROT_WRITE);
+    }
+
+    uint32_t sc = fault_table[((unsigned)has_vma << 3) | ((unsigned)is_file << 2)
+                              | ((unsigned)above_eof << 1) | (unsigned)write_ro];
+    int signo = sc & 0xffff;
+    int code  = sc >> 16;
+
+    if (file) {
+        put_handle(file);
     }
 
     deliver_signal(ALLOC_SIGINFO(signo, code, si_addr, (void *) arg), context);
@@ -414,20 +603,9 @@ ret_exception:
  *
  * The second option is faster in fault-free case but cannot be used under
  * SGX PAL. We use the best option for each PAL for now. */
-static bool is_sgx_pal(void) {
-    static struct atomic_int sgx_pal = { .counter = 0 };
-    static struct atomic_int inited  = { .counter = 0 };
-
-    if (!atomic_read(&inited)) {
-        /* Ensure that is_sgx_pal is updated before initialized */
-        atomic_set(&sgx_pal, !strcmp_static(PAL_CB(host_type), "Linux-SGX"));
-        MB();
-        atomic_set(&inited, 1);
-    }
-    MB();
-
-    return atomic_read(&sgx_pal) != 0;
-}
+/* The PAL type is immutable, so it is resolved once in `init_signal` (which runs before any
+ * user syscall can reach `test_user_memory` / `test_user_string`). */
+static bool g_sgx_pal = false;
 
 /*
  * 'test_user_memory' and 'test_user_string' are helper functions for testing
@@ -438,20 +616,15 @@ static bool is_sgx_pal(void) {
  * with a concurrent system call. The purpose of these functions is simply for
  * the compatibility with programs that rely on the error numbers, such as the
  * LTP test suite. */
-bool test_user_memory (void * addr, size_t size, bool write)
-{
-    if (!size)
-        return false;
-
-    if (!access_ok(addr, size))
-        return true;
-
-    /* SGX path: check if [addr, addr+size) is addressable (in some VMA) */
-    if (is_sgx_pal())
-        return !is_in_adjacent_user_vmas(addr, size);
+/* SGX variant: check if [addr, addr+size) is addressable (in some VMA) */
+static bool test_user_memory_sgx(void* addr, size_t size, bool write) {
+    __UNUSED(write);
+    return !is_in_adjacent_user_vmas(addr, size);
+}
 
-    /* Non-SGX path: check if [addr, addr+size) is addressable by touching
-     * a byte of each page; invalid access will be caught in memfault_upcall */
+/* Non-SGX variant: check if [addr, addr+size) is addressable by touching
+ * a byte of each page; invalid access will be caught in memfault_upcall */
+static bool test_user_memory_probe(void* addr, size_t size, bool write) {
     shim_tcb_t * tcb = shim_get_tcb();
     assert(tcb && tcb->tp);
     __disable_preempt(tcb);
@@ -466,15 +639,27 @@ bool test_user_memory (void * addr, size_t size, bool write)
     /* enforce compiler to store tcb->test_range into memory */
     __asm__ volatile(""::: "memory");
 
-    /* Try to read or write into one byte inside each page */
-    void * tmp = addr;
-    while (tmp <= addr + size - 1) {
+    /* Try to read or write into one byte inside each page. Compute the page count up front
+     * instead of re-aligning the cursor on every iteration, and prefetch one page ahead so
+     * the page walk for the next iteration overlaps the current touch. */
+    char* page = (char*)ALLOC_ALIGN_DOWN_PTR(addr);
+    size_t npages = (ALLOC_ALIGN_DOWN((uintptr_t)addr + size - 1) - (uintptr_t)page)
+                    / ALLOC_ALIGNMENT + 1;
+    char* tmp = addr;
+    for (size_t i = 0; i < npages; i++) {
+        if (i + 1 < npages) {
+            if (write)
+                __builtin_prefetch(page + ALLOC_ALIGNMENT, /*rw=*/1);
+            else
+                __builtin_prefetch(page + ALLOC_ALIGNMENT, /*rw=*/0);
+        }
         if (write) {
             *(volatile char *) tmp = *(volatile char *) tmp;
         } else {
             *(volatile char *) tmp;
         }
-        tmp = ALLOC_ALIGN_UP_PTR(tmp + 1);
+        page += ALLOC_ALIGNMENT;
+        tmp = page;
     }
 
 ret_fault:
@@ -491,38 +676,72 @@ ret_fault:
     return has_fault;
 }
 
-/*
- * This function tests a user string with unknown length. It only tests
- * whether the memory is readable.
- */
-bool test_user_string (const char * addr)
+/* The PAL type never changes after startup, so bind the right variant once in `init_signal`
+ * (IFUNC-style) instead of re-branching on it for every syscall argument validation. */
+static bool (*g_test_user_memory_fn)(void*, size_t, bool) = test_user_memory_probe;
+
+bool test_user_memory (void * addr, size_t size, bool write)
 {
-    if (!access_ok(addr, 1))
-        return true;
+    if (!size)
+        return false;
 
-    size_t size, maxlen;
-    const char* next = ALLOC_ALIGN_UP_PTR(addr + 1);
+    if (!access_ok(addr, size))
+        return true;
 
-    /* SGX path: check if [addr, addr+size) is addressable (in some VMA). */
-    if (is_sgx_pal()) {
-        /* We don't know length but using unprotected strlen() is dangerous
-         * so we check string in chunks of 4K pages. */
-        do {
-            maxlen = next - addr;
+    return g_test_user_memory_fn(addr, size, write);
+}
 
-            if (!access_ok(addr, maxlen) || !is_in_adjacent_user_vmas((void*) addr, maxlen))
-                return true;
+/*
+ * Find the first NUL byte in [addr, addr+maxlen) word-at-a-time (the usual "haszero" bit trick),
+ * returning its offset, or maxlen if there is none. Compared to a byte-wise strnlen this issues
+ * one load per 8 bytes, and the loads double as the fault probe in test_user_string: no byte
+ * outside [ALIGN_DOWN(addr, 8), addr+maxlen) is ever touched, so probing cannot fault past
+ * the page that contains the scanned bytes.
+ */
+static size_t probe_strnlen(const char* addr, size_t maxlen) {
+    const char* p = addr;
+    const char* end = addr + maxlen;
+
+    /* byte-wise scan up to the first word boundary */
+    while (p < end && ((uintptr_t)p & (sizeof(uint64_t) - 1))) {
+        if (!*p)
+            return p - addr;
+        p++;
+    }
 
-            size = strnlen(addr, maxlen);
-            addr = next;
-            next = ALLOC_ALIGN_UP_PTR(addr + 1);
-        } while (size == maxlen);
+    /* word-wise scan; stop at the first word containing a NUL byte. The may_alias typedef
+     * keeps the wide load of what is really byte data legal under strict aliasing. */
+    typedef uint64_t __attribute__((__may_alias__)) word_t;
+    while (p + sizeof(word_t) <= end) {
+        word_t val = *(const word_t*)p;
+        if ((val - 0x0101010101010101UL) & ~val & 0x8080808080808080UL)
+            break;
+        p += sizeof(word_t);
+    }
 
-        return false;
+    /* byte-wise scan of the tail (or of the word that contains the NUL) */
+    while (p < end) {
+        if (!*p)
+            return p - addr;
+        p++;
     }
 
-    /* Non-SGX path: check if [addr, addr+size) is addressable by touching
-     * a byte of each page; invalid access will be caught in memfault_upcall. */
+    return maxlen;
+}
+
+/* SGX variant: scan for the NUL while walking the VMAs covering the string. This takes the
+ * VMA lock once for the whole string instead of re-walking the tree per 4K chunk. */
+static bool test_user_string_sgx(const char* addr) {
+    size_t len;
+    return !strlen_in_adjacent_user_vmas(addr, &len);
+}
+
+/* Non-SGX variant: check if [addr, addr+size) is addressable by touching
+ * a byte of each page; invalid access will be caught in memfault_upcall. */
+static bool test_user_string_probe(const char* addr) {
+    size_t size, maxlen;
+    const char* next = ALLOC_ALIGN_UP_PTR(addr + 1);
+
     shim_tcb_t * tcb = shim_get_tcb();
     assert(tcb && tcb->tp);
     __disable_preempt(tcb);
@@ -543,9 +762,10 @@ bool test_user_string (const char * addr)
 
         if (!access_ok(addr, maxlen))
             return true;
-        *(volatile char *) addr; /* try to read one byte from the page */
 
-        size = strnlen(addr, maxlen);
+        /* The scan itself reads the page and acts as the fault probe; an invalid access is
+         * caught in memfault_upcall via the watched range set above. */
+        size = probe_strnlen(addr, maxlen);
         addr = next;
         next = ALLOC_ALIGN_UP_PTR(addr + 1);
     } while (size == maxlen);
@@ -564,6 +784,20 @@ ret_fault:
     return has_fault;
 }
 
+static bool (*g_test_user_string_fn)(const char*) = test_user_string_probe;
+
+/*
+ * This function tests a user string with unknown length. It only tests
+ * whether the memory is readable.
+ */
+bool test_user_string (const char * addr)
+{
+    if (!access_ok(addr, 1))
+        return true;
+
+    return g_test_user_string_fn(addr);
+}
+
 void __attribute__((weak)) syscall_wrapper(void)
 {
     /*
@@ -586,13 +820,14 @@ static void illegal_upcall (PAL_PTR event, PAL_NUM arg, PAL_CONTEXT * context)
 
         uint8_t* rip = (uint8_t*)pal_context_get_ip(context);
         /*
-         * Emulate syscall instruction (opcode 0x0f 0x05);
-         * syscall instruction is prohibited in
+         * Emulate syscall instruction (opcode 0x0f 0x05, i.e. little-endian 0x050f when read as
+         * one 16-bit word); syscall instruction is prohibited in
          *   Linux-SGX PAL and raises a SIGILL exception and
          *   Linux PAL with seccomp and raise SIGSYS exception.
          */
+        typedef uint16_t __attribute__((__may_alias__)) opcode_t;
 #if 0
-        if (rip[-2] == 0x0f && rip[-1] == 0x05) {
+        if (*(const opcode_t*)(rip - 2) == 0x050f) {
             /* TODO: once finished, remove "#if 0" above. */
             /*
              * SIGSYS case (can happen with Linux PAL with seccomp)
@@ -610,7 +845,7 @@ static void illegal_upcall (PAL_PTR event, PAL_NUM arg, PAL_CONTEXT * context)
             context->rip = (long)&syscall_wrapper;
         } else
 #endif
-        if (rip[0] == 0x0f && rip[1] == 0x05) {
+        if (__builtin_expect(*(const opcode_t*)rip == 0x050f, 1)) {
             /*
              * SIGILL case (can happen in Linux-SGX PAL)
              * %rcx: syscall instruction must put an instruction-after-syscall
@@ -640,8 +875,10 @@ static void quit_upcall (PAL_PTR event, PAL_NUM arg, PAL_CONTEXT * context)
 {
     __UNUSED(arg);
     __UNUSED(context);
-    if (!is_internal_tid(get_cur_tid())) {
-        (void)do_kill_proc(0, get_cur_thread()->tgid, SIGTERM, /*use_ipc=*/false);
+    /* resolve the tcb once instead of separate tcb-based lookups for the tid and the thread */
+    shim_tcb_t* tcb = shim_get_tcb();
+    if (tcb && tcb->tp && !is_internal_tid(tcb->tid)) {
+        (void)do_kill_proc(0, tcb->tp->tgid, SIGTERM, /*use_ipc=*/false);
     }
     DkExceptionReturn(event);
 }
@@ -650,8 +887,9 @@ static void suspend_upcall (PAL_PTR event, PAL_NUM arg, PAL_CONTEXT * context)
 {
     __UNUSED(arg);
     __UNUSED(context);
-    if (!is_internal_tid(get_cur_tid())) {
-        (void)do_kill_proc(0, get_cur_thread()->tgid, SIGINT, /*use_ipc=*/false);
+    shim_tcb_t* tcb = shim_get_tcb();
+    if (tcb && tcb->tp && !is_internal_tid(tcb->tid)) {
+        (void)do_kill_proc(0, tcb->tp->tgid, SIGINT, /*use_ipc=*/false);
     }
     DkExceptionReturn(event);
 }
@@ -664,7 +902,7 @@ static void resume_upcall (PAL_PTR event, PAL_NUM arg, PAL_CONTEXT * context)
     if (!tcb || !tcb->tp)
         return;
 
-    if (!is_internal_tid(get_cur_tid())) {
+    if (!is_internal_tid(tcb->tid)) {
         int64_t preempt = __disable_preempt(tcb);
         if (preempt <= 1)
             __handle_signals(tcb);
@@ -675,6 +913,16 @@ static void resume_upcall (PAL_PTR event, PAL_NUM arg, PAL_CONTEXT * context)
 
 int init_signal (void)
 {
+    g_sgx_pal = PAL_CB(host_type_id) == PAL_HOST_LINUX_SGX;
+
+    g_libos_text_range.start = (uintptr_t)&__code_address;
+    g_libos_text_range.len   = (uintptr_t)&__code_address_end - (uintptr_t)&__code_address;
+
+    if (g_sgx_pal) {
+        g_test_user_memory_fn = test_user_memory_sgx;
+        g_test_user_string_fn = test_user_string_sgx;
+    }
+
     DkSetExceptionHandler(&arithmetic_error_upcall,     PAL_EVENT_ARITHMETIC_ERROR);
     DkSetExceptionHandler(&memfault_upcall,    PAL_EVENT_MEMFAULT);
     DkSetExceptionHandler(&illegal_upcall,     PAL_EVENT_ILLEGAL);
@@ -703,19 +951,19 @@ __sigset_t * set_sig_mask (struct shim_thread * thread,
     assert(thread);
 
     if (set) {
-        memcpy(&thread->signal_mask, set, sizeof(__sigset_t));
-
-        /* SIGKILL and SIGSTOP cannot be ignored */
-        __sigdelset(&thread->signal_mask, SIGKILL);
-        __sigdelset(&thread->signal_mask, SIGSTOP);
+        /* SIGKILL and SIGSTOP cannot be ignored. Publish the new mask as one release store so
+         * that a concurrent deliver_signal()/__handle_signals() on another thread never observes
+         * a torn mask (the memcpy + two __sigdelset were three separate stores). */
+        uint64_t mask = __sigset_word(set) & ~(__sigmask(SIGKILL) | __sigmask(SIGSTOP));
+        __atomic_store_n(&thread->signal_mask.__val[0], mask, __ATOMIC_RELEASE);
     }
 
     return &thread->signal_mask;
 }
 
 static __rt_sighandler_t get_sighandler(struct shim_thread* thread, int sig, bool allow_reset) {
-    lock(&thread->signal_handles->lock);
-    struct __kernel_sigaction* sig_action = &thread->signal_handles->actions[sig - 1];
+    struct shim_signal_handles* handles = thread->signal_handles;
+    struct __kernel_sigaction* sig_action = &handles->actions[sig - 1];
 
     /*
      * on amd64, sa_handler can be treated as sa_sigaction
@@ -726,57 +974,88 @@ static __rt_sighandler_t get_sighandler(struct shim_thread* thread, int sig, boo
 # error "get_sighandler: see the comment above"
 #endif
 
-    __rt_sighandler_t handler = (void*)sig_action->k_sa_handler;
+    __rt_sighandler_t handler;
+
+    /* Fast path: handler installation is rare but delivery is frequent, so read the action
+     * lock-free and use the sequence counter to detect a concurrent `sigaction`. A signal with
+     * SA_RESETHAND must update the action, so it takes the locked path below. */
+    uint32_t seq = __atomic_load_n(&handles->seq, __ATOMIC_ACQUIRE);
+    if (!(seq & 1)) {
+        handler = (void*)sig_action->k_sa_handler;
+        int sa_flags = sig_action->sa_flags;
+        /* order the action reads before the counter re-check (smp_rmb) */
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&handles->seq, __ATOMIC_RELAXED) == seq
+                && !(allow_reset && (sa_flags & SA_RESETHAND))) {
+            goto resolve;
+        }
+    }
+
+    lock(&handles->lock);
+    handler = (void*)sig_action->k_sa_handler;
     if (allow_reset && sig_action->sa_flags & SA_RESETHAND) {
+        signal_handles_write_begin(handles);
         sigaction_make_defaults(sig_action);
+        signal_handles_write_end(handles);
     }
+    unlock(&handles->lock);
 
+resolve:
     if ((void*)handler == (void*)SIG_IGN) {
         handler = NULL;
     } else if ((void*)handler == (void*)SIG_DFL) {
-        handler = default_sighandler[sig - 1];
+        handler = default_sighandler(sig);
     }
 
-    unlock(&thread->signal_handles->lock);
     return handler;
 }
 
+/* The handler is resolved by the caller; `handler` must not be NULL. Keeping resolution out of
+ * this function lets callers skip the context materialization below for ignored signals. */
 static void
-__handle_one_signal(shim_tcb_t* tcb, struct shim_signal* signal) {
+__handle_one_signal(shim_tcb_t* tcb, struct shim_signal* signal, __rt_sighandler_t handler) {
     struct shim_thread* thread = (struct shim_thread*)tcb->tp;
-    __rt_sighandler_t handler = NULL;
+    assert(handler);
 
     int sig = signal->info.si_signo;
 
-    handler = get_sighandler(thread, sig, /*allow_reset=*/true);
-
-    if (!handler)
-        return;
-
+    /* Per-delivery traces compile out of release builds: even with logging disabled at runtime
+     * each debug() costs a global load, a branch and the argument setup on the hot path. */
+#ifdef DEBUG
     debug("signal %d handled\n", sig);
+#endif
 
     // If the context is never stored in the signal, it means the signal is handled during
     // system calls, and before the thread is resumed.
-    if (!signal->context_stored)
+    if (!signal->context_stored) {
+        memset(&signal->context, 0, sizeof(signal->context));
         __store_context(tcb, NULL, signal);
+    }
 
-    struct shim_context* context = NULL;
+    /* Save the interrupted syscall context in a plain local instead of an __alloca'd copy:
+     * `struct shim_context` is three words, so the compiler can keep the snapshot in registers
+     * across the handler call rather than spilling through a stack pointer it cannot see
+     * through. */
+    struct shim_context saved_context;
+    bool restore_context = false;
 
     if (tcb->context.regs && shim_context_get_syscallnr(&tcb->context)) {
-        context = __alloca(sizeof(struct shim_context));
-        *context = tcb->context;
+        saved_context = tcb->context;
+        restore_context = true;
         shim_context_set_syscallnr(&tcb->context, 0);
     }
 
+#ifdef DEBUG
     debug("run signal handler %p (%d, %p, %p)\n", handler, sig, &signal->info,
           &signal->context);
+#endif
 
     (*handler) (sig, &signal->info, &signal->context);
 
     __atomic_store_n(&thread->signal_handled, true, __ATOMIC_RELEASE);
 
-    if (context)
-        tcb->context = *context;
+    if (restore_context)
+        tcb->context = saved_context;
 
     if (signal->pal_context)
         ucontext_to_pal_context(signal->pal_context, &signal->context);
@@ -794,44 +1073,84 @@ void __handle_signals(shim_tcb_t* tcb) {
         thread_exit(/*error_code=*/0, /*term_signal=*/0);
     }
 
-    while (__atomic_load_n(&thread->pending_signals, __ATOMIC_ACQUIRE)
-           || __atomic_load_n(&process_pending_signals_cnt, __ATOMIC_ACQUIRE)) {
-        struct shim_signal* signal = NULL;
+    while (true) {
+        uint64_t pending = (__atomic_load_n(&thread->pending_signal_map, __ATOMIC_ACQUIRE)
+                            | __atomic_load_n(&process_pending_signal_map, __ATOMIC_ACQUIRE))
+                           & ~__sigset_word(&thread->signal_mask);
+        if (!pending) {
+            break;
+        }
+
+        /* Deliver every signal found in this snapshot as one batch before reloading the maps:
+         * under a signal burst this amortizes the map loads across deliveries instead of
+         * restarting the scan after each handled signal. */
+        bool delivered = false;
+
+        while (pending) {
+            int sig = __builtin_ctzll(pending) + 1;
+            pending &= pending - 1;
 
-        for (int sig = 1; sig <= NUM_SIGS; sig++) {
-            if (!__sigismember(&thread->signal_mask, sig)) {
-                if ((signal = thread_pop_signal(thread, sig))) {
-                    break;
-                }
-                if ((signal = process_pop_signal(sig))) {
-                    break;
-                }
+            struct shim_signal* signal = thread_pop_signal(thread, sig);
+            if (!signal) {
+                signal = process_pop_signal(sig);
+            }
+            if (!signal) {
+                /* Both queues for `sig` turned out to be empty: the hint bits were stale, retire
+                 * them so subsequent scans skip this signal. */
+                clear_pending_signal_bit(&thread->pending_signal_map, &thread->signal_queue, sig);
+                clear_pending_signal_bit(&process_pending_signal_map, &process_signal_queue, sig);
+                continue;
             }
-        }
 
-        if (!signal) {
-            break;
-        }
+            /* Resolve the handler first: ignored signals are freed without ever materializing
+             * their (kilobyte-sized) context. */
+            __rt_sighandler_t handler = get_sighandler(thread, sig, /*allow_reset=*/true);
+            if (handler) {
+                __handle_one_signal(tcb, signal, handler);
+            }
+            signal_cache_free(thread, signal);
+            delivered = true;
 
-        if (!signal->context_stored) {
-            __store_context(tcb, NULL, signal);
+            /* The handler may have changed the thread's mask (e.g. via sigprocmask); drop
+             * signals that became blocked from the rest of this batch. */
+            pending &= ~__sigset_word(&thread->signal_mask);
         }
 
-        __handle_one_signal(tcb, signal);
-        free(signal);
+        if (!delivered) {
+            break;
+        }
     }
 }
 
+/* True if any pending signal (thread or process) is not blocked by `thread`'s mask. A hint,
+ * not a guarantee: a signal arriving right after the check is delivered by its sender or at
+ * the next call, exactly as with the snapshot scan in `__handle_signals`. */
+static inline bool has_deliverable_signals(struct shim_thread* thread) {
+    return (__atomic_load_n(&thread->pending_signal_map, __ATOMIC_ACQUIRE)
+            | __atomic_load_n(&process_pending_signal_map, __ATOMIC_ACQUIRE))
+           & ~__sigset_word(&thread->signal_mask);
+}
+
 void handle_signals(void) {
     shim_tcb_t * tcb = shim_get_tcb();
     assert(tcb);
 
+    /* This runs on every syscall return; gate it on the pending maps so the common case (no
+     * deliverable signal) costs two loads and a mask instead of the preemption counter RMWs
+     * and the delivery-loop setup. */
+    struct shim_thread* thread = tcb->tp;
+    if (thread && !thread->time_to_die && !has_deliverable_signals(thread))
+        return;
+
     int64_t preempt = __disable_preempt(tcb);
 
-    if (preempt > 1)
+    if (preempt > 1) {
+#ifdef DEBUG
         debug("signal delayed (%ld)\n", preempt);
-    else
+#endif
+    } else {
         __handle_signals(tcb);
+    }
 
     __enable_preempt(tcb);
 }
@@ -841,22 +1160,37 @@ int append_signal(struct shim_thread* thread, siginfo_t* info) {
 
     // TODO: ignore SIGCHLD even if it's masked, when handler is set to SIG_IGN (probably not here)
 
-    struct shim_signal* signal = malloc(sizeof(*signal));
+    /* Allocate from the calling thread's cache when possible (same discipline as in
+     * `deliver_signal`: only at the first preemption level). The object may later be freed into
+     * the consuming thread's cache instead - the caches recycle plain heap objects, so they do
+     * not care which thread an object was allocated by. */
+    shim_tcb_t* tcb = shim_get_tcb();
+    int64_t preempt = __disable_preempt(tcb);
+    bool use_cache = preempt == 1 && tcb->tp;
+
+    int ret = 0;
+    struct shim_signal* signal = use_cache ? signal_cache_alloc(tcb->tp)
+                                           : malloc(sizeof(*signal));
     if (!signal) {
-        return -ENOMEM;
+        ret = -ENOMEM;
+        goto out;
     }
 
-    /* save in signal */
+    /* Save in signal. Only the fields delivery looks at are initialized: the embedded context
+     * stays untouched here and is materialized lazily in `__handle_signals`, so signals that are
+     * dropped (queue full) or never delivered cost no kilobyte-sized zeroing. `pal_context` must
+     * be NULLed explicitly - `__handle_one_signal` dereferences it after running the handler. */
     __store_info(info, signal);
     signal->context_stored = false;
+    signal->pal_context = NULL;
 
     if (thread) {
-        if (append_thread_signal(thread, signal)) {
-            return 0;
+        if (__builtin_expect(append_thread_signal(thread, signal), 1)) {
+            goto out;
         }
     } else {
-        if (append_process_signal(signal)) {
-            return 0;
+        if (__builtin_expect(append_process_signal(signal), 1)) {
+            goto out;
         }
     }
 
@@ -867,15 +1201,23 @@ int append_signal(struct shim_thread* thread, siginfo_t* info) {
         debug("process");
     }
     debug(" is full, dropping the incoming signal\n");
-    free(signal);
+    if (use_cache) {
+        signal_cache_free(tcb->tp, signal);
+    } else {
+        free(signal);
+    }
     /* This is counter-intuitive, but we report success here: after all signal was successfully
      * delivered, just the queue was full. */
-    return 0;
+out:
+    __enable_preempt(tcb);
+    return ret;
 }
 
 #define __WCOREDUMP_BIT 0x80
 
-static void sighandler_kill(int sig, siginfo_t* info, void* ucontext) {
+/* The default-disposition handlers run at most once per process; keep them out of the hot
+ * delivery path's i-cache footprint. */
+static __attribute__((cold)) void sighandler_kill(int sig, siginfo_t* info, void* ucontext) {
     __UNUSED(info);
     __UNUSED(ucontext);
     debug("killed by signal %d\n", sig & ~__WCOREDUMP_BIT);
@@ -883,7 +1225,7 @@ static void sighandler_kill(int sig, siginfo_t* info, void* ucontext) {
     process_exit(0, sig);
 }
 
-static void sighandler_core (int sig, siginfo_t * info, void * ucontext)
+static __attribute__((cold)) void sighandler_core (int sig, siginfo_t * info, void * ucontext)
 {
     /* NOTE: This implementation only indicates the core dump for wait4()
      *       and friends. No actual core-dump file is created. */
@@ -891,39 +1233,27 @@ static void sighandler_core (int sig, siginfo_t * info, void * ucontext)
     sighandler_kill(sig, info, ucontext);
 }
 
-static __rt_sighandler_t default_sighandler[NUM_SIGS] = {
-        /* SIGHUP */    &sighandler_kill,
-        /* SIGINT */    &sighandler_kill,
-        /* SIGQUIT */   &sighandler_core,
-        /* SIGILL */    &sighandler_core,
-        /* SIGTRAP */   &sighandler_core,
-        /* SIGABRT */   &sighandler_core,
-        /* SIGBUS */    &sighandler_core,
-        /* SIGFPE */    &sighandler_core,
-        /* SIGKILL */   &sighandler_kill,
-        /* SIGUSR1 */   &sighandler_kill,
-        /* SIGSEGV */   &sighandler_core,
-        /* SIGUSR2 */   &sighandler_kill,
-        /* SIGPIPE */   &sighandler_kill,
-        /* SIGALRM */   &sighandler_kill,
-        /* SIGTERM */   &sighandler_kill,
-        /* SIGSTKFLT */ &sighandler_kill,
-        /* SIGCHLD */   NULL,
-        /* SIGCONT */   NULL,
-        /* SIGSTOP */   NULL,
-        /* SIGTSTP */   NULL,
-        /* SIGTTIN */   NULL,
-        /* SIGTTOU */   NULL,
-        /* SIGURG  */   NULL,
-        /* SIGXCPU */   &sighandler_core,
-        /* SIGXFSZ */   &sighandler_core,
-        /* SIGVTALRM */ &sighandler_kill,
-        /* SIGPROF   */ &sighandler_kill,
-        /* SIGWINCH  */ NULL,
-        /* SIGIO   */   &sighandler_kill,
-        /* SIGPWR  */   &sighandler_kill,
-        /* SIGSYS  */   &sighandler_core
-    };
+/* Default dispositions as bitmaps over the standard signals (bit position = signal number),
+ * reducing the resolution to a bit test instead of a load from a 64-pointer table. Signals with
+ * neither bit set are ignored by default (SIGCHLD, SIGCONT, the stop signals, SIGURG, SIGWINCH,
+ * and - as with the table this replaces - the real-time signals). */
+#define DEFAULT_KILL_MASK                                                                   \
+    ((1u << SIGHUP) | (1u << SIGINT) | (1u << SIGKILL) | (1u << SIGUSR1) | (1u << SIGUSR2)  \
+     | (1u << SIGPIPE) | (1u << SIGALRM) | (1u << SIGTERM) | (1u << SIGSTKFLT)              \
+     | (1u << SIGVTALRM) | (1u << SIGPROF) | (1u << SIGIO) | (1u << SIGPWR))
+#define DEFAULT_CORE_MASK                                                                   \
+    ((1u << SIGQUIT) | (1u << SIGILL) | (1u << SIGTRAP) | (1u << SIGABRT) | (1u << SIGBUS)  \
+     | (1u << SIGFPE) | (1u << SIGSEGV) | (1u << SIGXCPU) | (1u << SIGXFSZ) | (1u << SIGSYS))
+
+static __rt_sighandler_t default_sighandler(int sig) {
+    if (sig < 32) {
+        if ((DEFAULT_KILL_MASK >> sig) & 1)
+            return &sighandler_kill;
+        if ((DEFAULT_CORE_MASK >> sig) & 1)
+            return &sighandler_core;
+    }
+    return NULL;
+}
 
 BEGIN_CP_FUNC(pending_signals)
 {
@@ -958,7 +1288,8 @@ BEGIN_CP_FUNC(pending_signals)
         struct shim_rt_signal_queue* q = &process_signal_queue.rt_signal_queues[sig - SIGRTMIN];
         uint64_t idx = __atomic_load_n(&q->put_idx, __ATOMIC_ACQUIRE);
         while (__atomic_load_n(&q->get_idx, __ATOMIC_ACQUIRE) < idx && i < n) {
-            memcpy(&infos[i], &q->queue[(idx - 1) % ARRAY_SIZE(q->queue)]->info, sizeof(infos[i]));
+            memcpy(&infos[i], &q->queue[(idx - 1) % ARRAY_SIZE(q->queue)].signal->info,
+                   sizeof(infos[i]));
             idx--;
             i++;
         }
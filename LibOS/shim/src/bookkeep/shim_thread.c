@@ -160,6 +160,7 @@ static struct shim_signal_handles* alloc_default_signal_handles(void) {
             return NULL;
         }
         REF_SET(handles->ref_count, 1);
+        handles->seq = 0;
         for (size_t i = 0; i < ARRAY_SIZE(handles->actions); i++) {
             sigaction_make_defaults(&handles->actions[i]);
         }
@@ -248,6 +249,7 @@ struct shim_thread * get_new_thread (IDTYPE new_tid)
     thread->scheduler_event = DkNotificationEventCreate(PAL_TRUE);
     thread->exit_event = DkNotificationEventCreate(PAL_FALSE);
     thread->child_exit_event = DkNotificationEventCreate(PAL_FALSE);
+    prime_signal_cache(thread);
     return thread;
 
 out_error:
@@ -348,6 +350,9 @@ void put_thread(struct shim_thread* thread) {
         if (thread->exec)
             put_handle(thread->exec);
 
+        clear_signal_queue(thread);
+        clear_signal_cache(thread);
+
         if (!is_internal(thread))
             release_pid(thread->tid);
 
@@ -595,6 +600,13 @@ BEGIN_CP_FUNC(thread)
         new_thread->root   = NULL;
         new_thread->cwd    = NULL;
         memset(&new_thread->signal_queue, 0, sizeof(new_thread->signal_queue));
+        /* The cache freelist points into this process' internal heap, which is not migrated;
+         * the child must start with an empty cache (it re-primes lazily via
+         * `signal_cache_free`). The pending hints describe the queue emptied above. */
+        new_thread->signal_cache = NULL;
+        new_thread->signal_cache_len = 0;
+        new_thread->pending_signals = 0;
+        new_thread->pending_signal_map = 0;
         new_thread->robust_list = NULL;
         REF_SET(new_thread->ref_count, 0);
 
@@ -1074,6 +1074,49 @@ out:
     return ret;
 }
 
+bool strlen_in_adjacent_user_vmas(const char* addr, size_t* size_ptr) {
+    uintptr_t begin = (uintptr_t)addr;
+    bool ret = false;
+
+    spinlock_lock_signal_off(&vma_tree_lock);
+    struct shim_vma* vma = _lookup_vma(begin);
+    if (!vma || begin < vma->begin || (vma->flags & (VMA_INTERNAL | VMA_UNMAPPED))) {
+        goto out;
+    }
+
+    /* Scanning is confined to spans confirmed mapped beforehand, so it cannot fault while the
+     * tree lock is held. The common case (NUL within the containing VMA) is one scan; only if
+     * the string runs off the VMA do we extend across all adjacent user VMAs in one walk and
+     * finish with a single scan of the remainder, instead of re-scanning span by span. */
+    size_t span = (const char*)vma->end - addr;
+    size_t len = strnlen(addr, span);
+    if (len < span) {
+        *size_ptr = len;
+        ret = true;
+        goto out;
+    }
+
+    uintptr_t extent_end = vma->end;
+    struct shim_vma* next;
+    while ((next = _get_next_vma(vma)) && next->begin == extent_end
+            && !(next->flags & (VMA_INTERNAL | VMA_UNMAPPED))) {
+        vma = next;
+        extent_end = vma->end;
+    }
+
+    const char* p = addr + span;
+    span = (const char*)extent_end - p;
+    len = strnlen(p, span);
+    if (len < span) {
+        *size_ptr = (size_t)(p - addr) + len;
+        ret = true;
+    }
+
+out:
+    spinlock_unlock_signal_on(&vma_tree_lock);
+    return ret;
+}
+
 static size_t dump_all_vmas_with_buf(struct shim_vma_info* infos, size_t max_count,
                                      bool include_unmapped) {
     size_t size = 0;
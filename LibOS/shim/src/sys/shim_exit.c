@@ -180,14 +180,24 @@ bool kill_other_threads(void) {
     }
     DkThreadYieldExecution();
 
-    /* Wait for all other threads to exit. */
+    /* Wait for all other threads to exit. Start with plain yields (threads typically notice
+     * `time_to_die` within a scheduling quantum), then back off with exponentially growing
+     * sleeps so that a straggler thread does not keep us burning a host CPU. */
+    uint64_t sleep_us = 0;
     while (!check_last_thread()) {
         /* Tell other threads to exit again - the previous announcement could have been missed by
          * threads that were just being created. */
         if (walk_thread_list(mark_thread_to_die, get_cur_thread(), /*one_shot=*/false) != -ESRCH) {
             killed = true;
         }
-        DkThreadYieldExecution();
+        if (!sleep_us) {
+            DkThreadYieldExecution();
+            sleep_us = 1;
+        } else {
+            DkThreadDelayExecution(sleep_us);
+            if (sleep_us < 1000)
+                sleep_us *= 2;
+        }
     }
 
     return killed;
@@ -195,9 +205,12 @@ bool kill_other_threads(void) {
 
 noreturn void process_exit(int error_code, int term_signal) {
     /* If process_exit is invoked multiple times, only a single invocation proceeds past this
-     * point. */
+     * point. Check the flag with a plain load first: once somebody claimed the exit, every
+     * later caller (e.g. all other threads dying from the same fatal signal) takes the early
+     * branch without a locked RMW on the shared flag. */
     static int first = 0;
-    if (__atomic_exchange_n(&first, 1, __ATOMIC_RELAXED) != 0) {
+    if (__builtin_expect(__atomic_load_n(&first, __ATOMIC_RELAXED), 0)
+            || __atomic_exchange_n(&first, 1, __ATOMIC_RELAXED) != 0) {
         /* Just exit current thread. */
         thread_exit(error_code, term_signal);
     }
@@ -47,7 +47,9 @@ int shim_do_sigaction(int signum, const struct __kernel_sigaction* act,
     }
 
     if (act) {
+        signal_handles_write_begin(cur->signal_handles);
         memcpy(sigaction, act, sizeof(*sigaction));
+        signal_handles_write_end(cur->signal_handles);
     }
 
     unlock(&cur->signal_handles->lock);
@@ -130,9 +132,10 @@ int shim_do_sigaltstack(const stack_t* ss, stack_t* oss) {
         *oss = *cur_ss;
 
     void* sp = (void*)shim_context_get_sp(&(shim_get_tcb()->context));
-    /* check if thread is currently executing on an active altstack */
-    if (!(cur_ss->ss_flags & SS_DISABLE) && sp && cur_ss->ss_sp <= sp &&
-            sp < cur_ss->ss_sp + cur_ss->ss_size) {
+    /* check if thread is currently executing on an active altstack; the single unsigned
+     * subtract-compare replaces the two-sided range test */
+    if (!(cur_ss->ss_flags & SS_DISABLE) && sp &&
+            (uintptr_t)sp - (uintptr_t)cur_ss->ss_sp < (uintptr_t)cur_ss->ss_size) {
         if (oss)
             oss->ss_flags |= SS_ONSTACK;
         if (ss) {
@@ -264,7 +267,7 @@ static int _signal_one_thread(struct shim_thread* thread, void* _arg) {
         }
         arg->sent = true;
     }
-    if (arg->sent && !__sigismember(&thread->signal_mask, arg->sig)) {
+    if (arg->sent && !(__sigset_word(&thread->signal_mask) & __sigmask(arg->sig))) {
         if (thread == get_cur_thread()) {
             /* We are ending this walk anyway, lets reuse sent field to mark that current thread
              * needs to handle a signal. */
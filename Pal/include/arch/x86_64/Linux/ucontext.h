@@ -136,11 +136,18 @@ typedef struct ucontext {
     struct _libc_fpstate __fpregs_mem;
 } ucontext_t;
 
+/* The greg block is a fixed-size, 8-byte-aligned blob; copying it as a typed struct instead of
+ * calling memcpy lets the compiler emit straight-line wide moves on the signal delivery path
+ * (a libc memcpy may pick `rep movsb` or a size dispatcher for this size). */
+typedef struct {
+    gregset_t gregs;
+} __attribute__((__may_alias__)) gregset_blob_t;
+
 /* fpregs is shallow copied by only setting a pointer */
 static inline void ucontext_to_pal_context(PAL_CONTEXT* context, ucontext_t* uc) {
     static_assert(sizeof(uc->uc_mcontext.gregs) == offsetof(struct PAL_CONTEXT_, fpregs),
                   "uc's gregs and PAL_CONTEXT sizes are different");
-    memcpy(&context->r8, uc->uc_mcontext.gregs, sizeof(uc->uc_mcontext.gregs));
+    *(gregset_blob_t*)&context->r8 = *(gregset_blob_t*)&uc->uc_mcontext.gregs;
     context->fpregs = (PAL_XREGS_STATE*)uc->uc_mcontext.fpregs;
 }
 
@@ -148,7 +155,7 @@ static inline void ucontext_to_pal_context(PAL_CONTEXT* context, ucontext_t* uc)
 static inline void pal_context_to_ucontext(ucontext_t* uc, PAL_CONTEXT* context) {
     static_assert(sizeof(uc->uc_mcontext.gregs) == offsetof(struct PAL_CONTEXT_, fpregs),
                   "uc's gregs and PAL_CONTEXT sizes are different");
-    memcpy(uc->uc_mcontext.gregs, &context->r8, sizeof(uc->uc_mcontext.gregs));
+    *(gregset_blob_t*)&uc->uc_mcontext.gregs = *(gregset_blob_t*)&context->r8;
     uc->uc_mcontext.fpregs = (struct _libc_fpstate*)context->fpregs;
 }
 
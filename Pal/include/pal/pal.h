@@ -122,9 +122,18 @@ typedef struct PAL_MEM_INFO_ {
     PAL_NUM mem_total;
 } PAL_MEM_INFO;
 
+/* Numeric identifier of the host a PAL is built for; `PAL_CB(host_type)` keeps the
+ * human-readable name, this one is for cheap comparisons. */
+enum pal_host_id {
+    PAL_HOST_UNKNOWN = 0,
+    PAL_HOST_LINUX,
+    PAL_HOST_LINUX_SGX,
+};
+
 /********** PAL APIs **********/
 typedef struct PAL_CONTROL_ {
     PAL_STR host_type;
+    PAL_NUM host_type_id; /*!< one of `enum pal_host_id`, matching `host_type` */
     PAL_NUM process_id; /*!< An identifier of current picoprocess */
     PAL_NUM host_id;
 
@@ -455,6 +455,12 @@ noreturn void pal_main(
     set_debug_type();
 
     __pal_control.host_type          = XSTRINGIFY(HOST_TYPE);
+    /* `strcmp_static` against a literal constant-folds, so this is resolved at compile time */
+    __pal_control.host_type_id       = !strcmp_static(XSTRINGIFY(HOST_TYPE), "Linux-SGX")
+                                       ? PAL_HOST_LINUX_SGX
+                                       : !strcmp_static(XSTRINGIFY(HOST_TYPE), "Linux")
+                                       ? PAL_HOST_LINUX
+                                       : PAL_HOST_UNKNOWN;
     __pal_control.process_id         = _DkGetProcessId();
     __pal_control.host_id            = _DkGetHostId();
     __pal_control.manifest_handle    = manifest_handle;
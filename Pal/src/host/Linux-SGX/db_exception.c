@@ -91,21 +91,12 @@ static void save_pal_context(PAL_CONTEXT* ctx, sgx_cpu_context_t* uc,
     assert(xregs_state);
     ctx->fpregs = xregs_state;
 
-    /* Emulate format for fp registers Linux sets up as signal frame.
-     * https://elixir.bootlin.com/linux/v5.4.13/source/arch/x86/kernel/fpu/signal.c#L86
-     * https://elixir.bootlin.com/linux/v5.4.13/source/arch/x86/kernel/fpu/signal.c#L459
-     */
-    PAL_FPX_SW_BYTES* fpx_sw = &xregs_state->fpstate.sw_reserved;
-    fpx_sw->magic1 = PAL_FP_XSTATE_MAGIC1;
-    fpx_sw->extended_size = xsave_size;
-    fpx_sw->xfeatures = xsave_features;
-    memset(fpx_sw->padding, 0, sizeof(fpx_sw->padding));
+    /* The sw_reserved block is a process-wide constant, precomputed in init_xsave_size(); only
+     * the trailing magic has to be (re)placed, since it lives past the fxsave area. */
+    xregs_state->fpstate.sw_reserved = xsave_fpx_sw_bytes;
     if (xsave_enabled) {
-        fpx_sw->xstate_size = xsave_size + PAL_FP_XSTATE_MAGIC2_SIZE;
         *(__typeof__(PAL_FP_XSTATE_MAGIC2)*)((void*)xregs_state + xsave_size) =
             PAL_FP_XSTATE_MAGIC2;
-    } else {
-        fpx_sw->xstate_size = xsave_size;
     }
 }
 
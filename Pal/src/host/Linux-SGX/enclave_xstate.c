@@ -51,6 +51,22 @@
 int xsave_enabled = 0;
 uint64_t xsave_features = 0;
 uint32_t xsave_size = 0;
+
+/* Variants of the save/restore entry points in enclave_entry.S. They use a custom calling
+ * convention (argument in %rdi, return address in %r11), so they are never called from C and
+ * their type here is opaque. __save_xregs/__restore_xregs dispatch through the _impl pointers,
+ * selected once below instead of re-testing the feature flags on every context save. */
+extern char __save_xregs_fxsave[];
+extern char __save_xregs_xsave[];
+extern char __restore_xregs_fxrstor[];
+extern char __restore_xregs_xrstor[];
+
+void* save_xregs_impl    = &__save_xregs_fxsave;
+void* restore_xregs_impl = &__restore_xregs_fxrstor;
+/* Precomputed sw_reserved block for signal frames; all of its fields are process-wide
+ * constants once init_xsave_size() ran, so exception handling can copy it wholesale
+ * instead of re-deriving it (see save_pal_context() in db_exception.c). */
+PAL_FPX_SW_BYTES xsave_fpx_sw_bytes = { 0 };
 //FXRSTOR only cares about the first 512 bytes, while
 //XRSTOR in compacted mode will ignore the first 512 bytes.
 const uint32_t xsave_reset_state[XSAVE_RESET_STATE_SIZE/sizeof(uint32_t)]
@@ -83,7 +99,7 @@ void init_xsave_size(uint64_t xfrm) {
     xsave_size = 512 + 64;
     if (!xfrm || (xfrm & SGX_XFRM_RESERVED)) {
         SGX_DBG(DBG_M, "xsave is disabled, xfrm 0x%lx\n", xfrm);
-        return;
+        goto out;
     }
 
     xsave_enabled = (xfrm == SGX_XFRM_LEGACY) ? 0 : 1;
@@ -94,4 +110,23 @@ void init_xsave_size(uint64_t xfrm) {
         }
     }
     SGX_DBG(DBG_M, "xsave is enabled with xsave_size: %u\n", xsave_size);
+
+out:
+    if (xsave_enabled) {
+        save_xregs_impl    = &__save_xregs_xsave;
+        restore_xregs_impl = &__restore_xregs_xrstor;
+    } else {
+        save_xregs_impl    = &__save_xregs_fxsave;
+        restore_xregs_impl = &__restore_xregs_fxrstor;
+    }
+
+    /* Emulate format for fp registers Linux sets up as signal frame.
+     * https://elixir.bootlin.com/linux/v5.4.13/source/arch/x86/kernel/fpu/signal.c#L86
+     * https://elixir.bootlin.com/linux/v5.4.13/source/arch/x86/kernel/fpu/signal.c#L459
+     */
+    xsave_fpx_sw_bytes.magic1        = PAL_FP_XSTATE_MAGIC1;
+    xsave_fpx_sw_bytes.extended_size = xsave_size;
+    xsave_fpx_sw_bytes.xfeatures     = xsave_features;
+    xsave_fpx_sw_bytes.xstate_size   = xsave_size
+                                       + (xsave_enabled ? PAL_FP_XSTATE_MAGIC2_SIZE : 0);
 }
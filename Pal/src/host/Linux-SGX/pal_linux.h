@@ -96,6 +96,7 @@ extern uint64_t xsave_features;
 extern uint32_t xsave_size;
 #define XSAVE_RESET_STATE_SIZE (512 + 64)  // 512 for legacy regs, 64 for xsave header
 extern const uint32_t xsave_reset_state[];
+extern PAL_FPX_SW_BYTES xsave_fpx_sw_bytes;
 
 void init_xsave_size(uint64_t xfrm);
 void save_xregs(PAL_XREGS_STATE* xsave_area);